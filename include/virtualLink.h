@@ -4,9 +4,27 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #define VIRTUAL_LINK_WAIT_FOREVER (-1)
 #define VIRTUAL_LINK_DONT_WAIT (0)
 
+#define VIRTUAL_LINK_INTEGRITY_TRAILER_SIZE (sizeof(uint32_t))
+
+#define VIRTUAL_LINK_INIT_MANY_MAX_THREADS (16)
+
+enum virtualLinkStatus {
+	VIRTUAL_LINK_STATUS_OK = 0,
+	VIRTUAL_LINK_STATUS_INVALID_CONFIG,
+	VIRTUAL_LINK_STATUS_TX_SOCKET_FAILED,
+	VIRTUAL_LINK_STATUS_RX_SOCKET_FAILED,
+	VIRTUAL_LINK_STATUS_EPOLL_FAILED,
+	VIRTUAL_LINK_STATUS_MULTICAST_JOIN_FAILED,
+	VIRTUAL_LINK_STATUS_TIMER_FAILED,
+};
+
 struct virtualLinkSocketAddress {
 	uint32_t ipv4_address;
 	uint16_t port;
@@ -22,26 +40,45 @@ struct virtualLinkConfig {
 	struct virtualLinkSocketAddress rx_socket_address;
 	uint32_t interface_ipv4_address;
 
+	uint8_t dscp;		/* DSCP set on transmitted packets, 0 - default class */
+	int socket_priority;	/* SO_PRIORITY of both sockets, 0 - default priority */
+	bool is_integrity_trailer_enabled; /* Append and verify CRC32C trailer */
+
 	void *rx_buffer;
 	size_t rx_buffer_size;
 };
 
+/* Object has to be defined as non-const, as statistics (e.g. integrity failures count)
+   are updated also by functions taking const pointer to it */
 struct virtualLinkObject {
 	struct virtualLinkConfig _config;
 
 	int _tx_socket_fd;
 	int _rx_socket_fd;
 	int _epoll_descriptor;
+	int _timer_fd;
 
 	struct {
 		virtualLinkRxDoneCallbackFunction *function;
 		void *user_data;
 	} _rx_done_callback;
 
+	uint32_t _integrity_failures_count;
+
 	bool _is_initialized;
 	bool _is_rx_interrupt_enabled;
 };
 
+struct virtualLinkLanes {
+	/* Lanes ordered by priority, objects[0] is the most important one */
+	const struct virtualLinkObject *const *objects;
+	size_t objects_count;
+	/* Max amount of packets processed from single lane during one pass, has to be > 0 */
+	size_t budget_per_lane;
+
+	int _epoll_descriptor;
+};
+
 /* ----------------------------------------- Meta API ------------------------------------------ */
 /**
  * @brief Processing loop
@@ -54,6 +91,24 @@ void virtualLink_Meta_processingLoop(const struct virtualLinkObject *const objec
 
 void virtualLink_Meta_runProcessingThread(const struct virtualLinkObject *const object);
 
+/**
+ * @brief Prioritized processing loop
+ *        Process awaiting packets of all lanes, starting from the most important one.
+ *        At most budget_per_lane packets are processed from each lane during one call.
+ *	  It should be used only in single-threaded aplication.
+ *	  Do not mix it with virtualLink_Meta_runPrioritizedProcessingThread().
+ * @param[in] lanes Pointer to lanes description
+ */
+void virtualLink_Meta_prioritizedProcessingLoop(const struct virtualLinkLanes *const lanes);
+
+/**
+ * @brief Run thread processing lanes in prioritized manner
+ *        Thread sleeps until any lane receives data and then runs prioritized processing loop.
+ *        lanes and all lane objects have to stay valid as long as thread is running.
+ * @param[in,out] lanes Pointer to lanes description
+ */
+void virtualLink_Meta_runPrioritizedProcessingThread(struct virtualLinkLanes *const lanes);
+
 /* -------------------------------------------- API -------------------------------------------- */
 /**
  * @brief Fill config structure by providing appropriate strings
@@ -78,6 +133,58 @@ bool virtualLink_configFromStrings(struct virtualLinkConfig *const config,
 void virtualLink_init(struct virtualLinkObject *const object,
 		      const struct virtualLinkConfig *const config);
 
+/**
+ * @brief Init virtualLink object, reporting failures instead of asserting
+ *        All resources allocated before failure are released.
+ * 
+ * @param[out] object Pointer to virtualLink object
+ * @param[in] config Pointer to virtualLink configuration
+ * @return Status of initialization
+ */
+enum virtualLinkStatus virtualLink_tryInit(struct virtualLinkObject *const object,
+					   const struct virtualLinkConfig *const config);
+
+/**
+ * @brief Load configs of multiple links from file
+ *        Each non-empty line not starting with '#' describes one link:
+ *        <interface IPv4> <TX IPv4:port> <RX IPv4:port> [dscp=<0-63>] [priority=<n>] [integrity]
+ *        Links reusing TX address of earlier valid link are marked as invalid config.
+ *        rx_buffer of loaded configs is NULL and has to be filled before initialization.
+ * 
+ * @param[in] path Path to config file
+ * @param[out] configs Array where loaded configs will be stored
+ * @param[out] statuses Array where validation status of each config will be stored
+ * @param[in] configs_max_count Size of configs and statuses arrays
+ * @param[out] configs_count Amount of links found in file
+ * @return Bool informing if file has been read and all links fit into configs
+ */
+bool virtualLink_loadConfigsFromFile(const char *const path,
+				     struct virtualLinkConfig *const configs,
+				     enum virtualLinkStatus *const statuses,
+				     size_t configs_max_count,
+				     size_t *const configs_count);
+
+/**
+ * @brief Init multiple virtualLink objects in parallel
+ *        If validation_statuses is provided (e.g. statuses returned by
+ *        virtualLink_loadConfigsFromFile()), objects whose validation status is not
+ *        VIRTUAL_LINK_STATUS_OK are skipped and their validation status is copied to statuses.
+ *        Pass NULL to initialize all objects.
+ * 
+ * @param[out] objects Array of virtualLink objects
+ * @param[in] configs Array of virtualLink configurations
+ * @param[in] validation_statuses Optional array of validation statuses, may be NULL
+ * @param[out] statuses Array filled with status of each object, every entry is written
+ * @param[in] objects_count Size of objects, configs and statuses arrays
+ * @param[in] threads_count Amount of threads used (capped to VIRTUAL_LINK_INIT_MANY_MAX_THREADS)
+ */
+void virtualLink_initMany(struct virtualLinkObject *const objects,
+			  const struct virtualLinkConfig *const configs,
+			  const enum virtualLinkStatus *const validation_statuses,
+			  enum virtualLinkStatus *const statuses,
+			  size_t objects_count,
+			  size_t threads_count);
+
 /**
  * @brief Send data over virtualLink in blocking manner (no internal FIFO)
  * 
@@ -85,7 +192,7 @@ void virtualLink_init(struct virtualLinkObject *const object,
  * @param[in] tx_data Pointer to data that should be send
  * @param[in] tx_data_size The size of tx data
  *
- * @return Amount of bytes that has been sent
+ * @return Amount of bytes that has been sent, integrity trailer not included
  */
 size_t virtualLink_sendDataBlocking(const struct virtualLinkObject *const object,
 				    const void *const tx_data, size_t tx_data_size);
@@ -106,6 +213,26 @@ size_t virtualLink_receiveDataBlocking(const struct virtualLinkObject *const obj
 				       int timeout_ms,
 				       struct virtualLinkSocketAddress *const originator_address);
 
+/**
+ * @brief Receive data over virtualLink in blocking manner with nanosecond timeout
+ *        Timeout is measured against CLOCK_MONOTONIC, so it is not affected by system time
+ *        changes. VIRTUAL_LINK_WAIT_FOREVER and VIRTUAL_LINK_DONT_WAIT can be used as well.
+ *        Kernel waits use epoll_pwait2() (glibc >= 2.35 and kernel >= 5.11), otherwise
+ *        sub-milisecond timeouts are served by link's timerfd.
+ * 
+ * @param[in] object Pointer to virtualLink object
+ * @param[in] rx_buffer Pointer to buffer where incoming data should be stored
+ * @param[in] rx_bytes_read_size Amount of bytes that should be read and stored into buffer
+ * @param[in] timeout_ns Timeout for data reception, given in nanoseconds
+ * @param[out] originator_address Pointer to struct where data's originator will be stored
+ *
+ * @return Amount of bytes that has been received
+ */
+size_t virtualLink_receiveDataBlockingNs(const struct virtualLinkObject *const object,
+					 void *const rx_buffer, size_t rx_bytes_read_size,
+					 int64_t timeout_ns,
+					 struct virtualLinkSocketAddress *const originator_address);
+
 /**
  * @brief Enable RX interrupt
  *
@@ -125,3 +252,40 @@ void virtualLink_registerRxDoneCallback(struct virtualLinkObject *const object,
 					virtualLinkRxDoneCallbackFunction *function,
 					void *user_data);
 
+/**
+ * @brief Get count of packets dropped due to integrity trailer verification failure
+ *
+ * @param[in] object Pointer to virtualLink object
+ *
+ * @return Count of dropped packets
+ */
+uint32_t virtualLink_getIntegrityFailuresCount(const struct virtualLinkObject *const object);
+
+/**
+ * @brief Get file descriptor that becomes readable when data is awaiting
+ *        It can be added to external epoll/poll/io_uring based event loop.
+ *        Use virtualLink_drain() to process data once descriptor is readable.
+ *
+ * @param[in] object Pointer to virtualLink object
+ *
+ * @return Pollable file descriptor
+ */
+int virtualLink_getPollFd(const struct virtualLinkObject *const object);
+
+/**
+ * @brief Process awaiting packets without blocking
+ *        Every received packet is passed to RX done callback when RX interrupt is enabled
+ *        and dropped otherwise, so poll fd never stays readable because of unread packets.
+ *        When used with edge-triggered event loop, call it again if whole budget was used,
+ *        as there may be packets left.
+ *
+ * @param[in] object Pointer to virtualLink object
+ * @param[in] budget Max amount of packets that should be processed
+ *
+ * @return Amount of processed packets, including dropped ones
+ */
+size_t virtualLink_drain(const struct virtualLinkObject *const object, size_t budget);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "virtualLink.h"
+
+namespace virtualLink {
+
+/* ------------------------------------------ Helpers ------------------------------------------ */
+namespace detail {
+
+template <typename T, typename... Ts>
+struct indexOf;
+
+template <typename T, typename... Ts>
+struct indexOf<T, T, Ts...> : std::integral_constant<std::size_t, 0> {};
+
+template <typename T, typename U, typename... Ts>
+struct indexOf<T, U, Ts...>
+	: std::integral_constant<std::size_t, 1 + indexOf<T, Ts...>::value> {};
+
+template <typename T>
+struct indexOf<T> {
+	static_assert(sizeof(T) == 0, "Message type is not part of this channel");
+};
+
+template <typename T, typename... Ts>
+inline constexpr bool isUnique = (!std::is_same_v<T, Ts> && ...);
+
+template <typename... Ts>
+struct areUnique : std::true_type {};
+
+template <typename T, typename... Ts>
+struct areUnique<T, Ts...>
+	: std::bool_constant<isUnique<T, Ts...> && areUnique<Ts...>::value> {};
+
+constexpr std::size_t maxOf(std::initializer_list<std::size_t> values) {
+	std::size_t max = 0;
+	for (const std::size_t value : values) {
+		max = (value > max) ? value : max;
+	}
+	return max;
+}
+
+} // namespace detail
+
+/* ------------------------------------------ Channel ------------------------------------------ */
+/**
+ * @brief Typed message channel over virtualLink object
+ *        Every datagram consists of message ID followed by message payload. Message ID is
+ *        an index of message type in Msgs pack, so both sides have to use the same pack.
+ *        Message ID and payload are sent in host byte order, so both sides have to share
+ *        endianness (unlike the integrity trailer, which is sent in network byte order).
+ *        Messages are constructed directly in TX frame and handed over to receive handlers
+ *        as views into RX frame, so no additional copies are made.
+ *
+ * @tparam Msgs Trivially copyable message types that can be sent over the channel
+ */
+template <typename... Msgs>
+class Channel {
+	static_assert(sizeof...(Msgs) > 0,
+		      "Channel needs at least one message type");
+	static_assert((std::is_trivially_copyable_v<Msgs> && ...),
+		      "Messages have to be trivially copyable");
+	static_assert((std::is_standard_layout_v<Msgs> && ...),
+		      "Messages have to have standard layout");
+	static_assert(detail::areUnique<Msgs...>::value,
+		      "Message types have to be unique");
+
+public:
+	using MessageId = uint16_t;
+
+	static_assert(sizeof...(Msgs) <= UINT16_MAX,
+		      "Too many message types for MessageId");
+
+	/** Offset of payload in frame - keeps payload aligned for every message type */
+	static constexpr std::size_t payload_offset =
+		detail::maxOf({sizeof(MessageId), alignof(Msgs)...});
+	/** Size of the biggest frame that can be sent over the channel */
+	static constexpr std::size_t max_frame_size =
+		payload_offset + detail::maxOf({sizeof(Msgs)...});
+
+	/** Storage that can hold any frame of this channel */
+	struct alignas(payload_offset) Frame {
+		std::byte data[max_frame_size];
+	};
+
+	/**
+	 * @brief Get compile-time ID of message type
+	 */
+	template <typename Msg>
+	static constexpr MessageId id() {
+		return static_cast<MessageId>(detail::indexOf<Msg, Msgs...>::value);
+	}
+
+	/**
+	 * @brief Create channel over already initialized virtualLink object
+	 *
+	 * @param[in] object virtualLink object used for transmission
+	 */
+	explicit Channel(struct virtualLinkObject &object) : _object(object) {}
+
+	/**
+	 * @brief Construct message directly in TX frame and send it in blocking manner
+	 *
+	 * @param[in] args Arguments passed to Msg constructor (or aggregate initializer)
+	 * @return Amount of bytes that has been sent, including message ID
+	 */
+	template <typename Msg, typename... Args>
+	std::size_t emplace(Args &&...args) {
+		Frame frame;
+
+		// Clear padding between ID and payload, so no stack contents are sent
+		std::memset(frame.data, 0, payload_offset);
+
+		const MessageId message_id = id<Msg>();
+		std::memcpy(frame.data, &message_id, sizeof(message_id));
+		::new (static_cast<void *>(frame.data + payload_offset))
+			Msg{std::forward<Args>(args)...};
+
+		return virtualLink_sendDataBlocking(&_object,
+						    frame.data, payload_offset + sizeof(Msg));
+	}
+
+	/**
+	 * @brief Send message in blocking manner
+	 *
+	 * @param[in] message Message that should be send
+	 * @return Amount of bytes that has been sent, including message ID
+	 */
+	template <typename Msg>
+	std::size_t send(const Msg &message) {
+		return emplace<Msg>(message);
+	}
+
+	/**
+	 * @brief Dispatch received frame to handler overload matching its message type
+	 *        rx_data has to be aligned as Frame (e.g. point to Frame or to RX buffer
+	 *        declared as Frame), as handler gets view directly into it.
+	 *
+	 * @param[in] rx_data Pointer to received frame
+	 * @param[in] rx_data_size Size of received frame
+	 * @param[in] handler Callable accepting const Msg& for every Msg of the channel
+	 * @return Bool informing if frame has been recognized and dispatched
+	 */
+	template <typename Handler>
+	static bool dispatch(const void *const rx_data, std::size_t rx_data_size,
+			     Handler &&handler) {
+		assert((nullptr != rx_data)
+		       && "rx_data cannot be NULL");
+		assert((0 == (reinterpret_cast<std::uintptr_t>(rx_data) % payload_offset))
+		       && "rx_data has to be aligned as Frame");
+
+		if (rx_data_size < payload_offset) {
+			return false;
+		}
+
+		MessageId message_id;
+		std::memcpy(&message_id, rx_data, sizeof(message_id));
+		if (message_id >= sizeof...(Msgs)) {
+			return false;
+		}
+
+		// Fold over message IDs - compiler lowers it to jump table and inlines handlers,
+		// which an array of function pointers would prevent
+		const std::byte *const payload =
+			static_cast<const std::byte *>(rx_data) + payload_offset;
+		const std::size_t payload_size = rx_data_size - payload_offset;
+		return ((id<Msgs>() == message_id
+			 && dispatchAs<Msgs>(payload, payload_size, handler)) || ...);
+	}
+
+	/**
+	 * @brief Receive single frame and dispatch it to handler
+	 *
+	 * @param[in] frame Frame where incoming data should be stored
+	 * @param[in] timeout_ns Timeout for data reception, given in nanoseconds
+	 * @param[in] handler Callable accepting const Msg& for every Msg of the channel
+	 * @return Bool informing if message has been received and dispatched
+	 */
+	template <typename Handler>
+	bool receive(Frame &frame, int64_t timeout_ns, Handler &&handler) {
+		const std::size_t rx_size =
+			virtualLink_receiveDataBlockingNs(&_object,
+							  frame.data, sizeof(frame.data),
+							  timeout_ns,
+							  nullptr);
+
+		return dispatch(frame.data, rx_size, std::forward<Handler>(handler));
+	}
+
+private:
+	template <typename Msg, typename Handler>
+	static inline bool dispatchAs(const std::byte *const payload, std::size_t payload_size,
+			       Handler &handler) {
+		if (sizeof(Msg) != payload_size) {
+			return false;
+		}
+
+		handler(*std::launder(reinterpret_cast<const Msg *>(payload)));
+		return true;
+	}
+
+	struct virtualLinkObject &_object;
+};
+
+} // namespace virtualLink
@@ -0,0 +1,124 @@
+#include <assert.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#endif
+
+#include "crc32c.h"
+
+#define CRC32C_POLYNOMIAL_REVERSED (0x82F63B78u)
+#define CRC32C_SLICES (8)
+
+typedef uint32_t crc32cKernelFunction(uint32_t crc, const uint8_t *data, size_t data_size);
+
+static uint32_t crc32c_table[CRC32C_SLICES][256];
+static crc32cKernelFunction *crc32c_kernel;
+static pthread_once_t crc32c_init_once = PTHREAD_ONCE_INIT;
+
+static inline uint64_t readU64(const uint8_t *const data) {
+	uint64_t value;
+	memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+static void initTable(void) {
+	for (uint32_t i = 0; i < 256; i++) {
+		uint32_t crc = i;
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc >> 1) ^ ((crc & 1u) ? CRC32C_POLYNOMIAL_REVERSED : 0u);
+		}
+		crc32c_table[0][i] = crc;
+	}
+
+	for (uint32_t i = 0; i < 256; i++) {
+		for (int slice = 1; slice < CRC32C_SLICES; slice++) {
+			const uint32_t previous = crc32c_table[slice - 1][i];
+			crc32c_table[slice][i] = (previous >> 8) ^ crc32c_table[0][previous & 0xFFu];
+		}
+	}
+}
+
+static uint32_t portableKernel(uint32_t crc, const uint8_t *data, size_t data_size) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	// Process 8 bytes at once (slicing-by-8)
+	while (data_size >= sizeof(uint64_t)) {
+		const uint64_t word = readU64(data) ^ crc;
+		crc = crc32c_table[7][word & 0xFFu]
+		      ^ crc32c_table[6][(word >> 8) & 0xFFu]
+		      ^ crc32c_table[5][(word >> 16) & 0xFFu]
+		      ^ crc32c_table[4][(word >> 24) & 0xFFu]
+		      ^ crc32c_table[3][(word >> 32) & 0xFFu]
+		      ^ crc32c_table[2][(word >> 40) & 0xFFu]
+		      ^ crc32c_table[1][(word >> 48) & 0xFFu]
+		      ^ crc32c_table[0][word >> 56];
+
+		data += sizeof(uint64_t);
+		data_size -= sizeof(uint64_t);
+	}
+#endif
+
+	// Process remaining bytes one by one
+	while (0 < data_size) {
+		crc = (crc >> 8) ^ crc32c_table[0][(crc ^ *data) & 0xFFu];
+		data++;
+		data_size--;
+	}
+
+	return crc;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.2")))
+static uint32_t sse42Kernel(uint32_t crc, const uint8_t *data, size_t data_size) {
+	uint64_t crc64 = crc;
+
+	while (data_size >= sizeof(uint64_t)) {
+		crc64 = _mm_crc32_u64(crc64, readU64(data));
+		data += sizeof(uint64_t);
+		data_size -= sizeof(uint64_t);
+	}
+
+	crc = (uint32_t)crc64;
+	while (0 < data_size) {
+		crc = _mm_crc32_u8(crc, *data);
+		data++;
+		data_size--;
+	}
+
+	return crc;
+}
+#endif
+
+static void selectKernel(void) {
+	initTable();
+	crc32c_kernel = portableKernel;
+
+#if defined(__x86_64__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("sse4.2")) {
+		crc32c_kernel = sse42Kernel;
+	}
+#endif
+}
+
+uint32_t crc32c_calculate(const void *const data, size_t data_size) {
+	assert(((NULL != data) || (0 == data_size))
+	       && "data cannot be NULL");
+
+	pthread_once(&crc32c_init_once, selectKernel);
+
+	return ~crc32c_kernel(~0u, data, data_size);
+}
+
+uint32_t crc32c_calculatePortable(const void *const data, size_t data_size) {
+	assert(((NULL != data) || (0 == data_size))
+	       && "data cannot be NULL");
+
+	pthread_once(&crc32c_init_once, selectKernel);
+
+	return ~portableKernel(~0u, data, data_size);
+}
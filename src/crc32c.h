@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Calculate CRC32C (Castagnoli) checksum of data
+ *        Hardware accelerated kernel is used when CPU supports it,
+ *        portable slicing-by-8 kernel otherwise. Kernel is chosen at first call.
+ *
+ * @param[in] data Pointer to data
+ * @param[in] data_size The size of data
+ *
+ * @return CRC32C checksum of data
+ */
+uint32_t crc32c_calculate(const void *const data, size_t data_size);
+
+/**
+ * @brief Calculate CRC32C checksum of data using portable kernel only
+ *        Exposed to verify portable kernel also on CPUs with hardware acceleration.
+ *
+ * @param[in] data Pointer to data
+ * @param[in] data_size The size of data
+ *
+ * @return CRC32C checksum of data
+ */
+uint32_t crc32c_calculatePortable(const void *const data, size_t data_size);
@@ -1,22 +1,39 @@
 #include <arpa/inet.h>
 #include <assert.h>
+#include <errno.h>
 #include <inttypes.h>
+#include <limits.h>
 #include <netdb.h>
 #include <netinet/ip.h>
 #include <pthread.h>
 #include <sys/epoll.h>
 #include <sys/time.h>
 #include <stddef.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
 
+#include "crc32c.h"
 #include "logger/logger.h"
-#include "systemTime.h"
 #include "virtualLink.h"
 
 LOGGER_REGISTER_MODULE("virtualLink", LOG_LEVEL_NONE);
 
+#define NS_IN_MS (1000000LL)
+#define NS_IN_S (1000000000LL)
+
+// __GLIBC_PREREQ cannot be used in the same #if as defined(__GLIBC__) on other libcs
+#if defined(__GLIBC__)
+#if __GLIBC_PREREQ(2, 35)
+#define VIRTUAL_LINK_HAS_EPOLL_PWAIT2
+#endif
+#endif
+
 /*
 static void printSocketAddress(const struct sockaddr_in *const socket_address) {
 	char ipv4_string[sizeof("255.255.255.255")];
@@ -63,9 +80,18 @@ static bool socketAddressFromString(const char *const socket_address_string,
 			break;
 		}
 
+		if (c == '\0') {
+			break;
+		}
+
 		ip_v4_address_string[i] = c;
 	}
 
+	if (!was_colon_detected) {
+		// Missing port or too long IPv4 address
+		return false;
+	}
+
 	// Convert IPv4 addres string into in_addr_t
 	const uint32_t ipv4_address_number = (uint32_t)inet_addr(ip_v4_address_string);
 	if (INADDR_NONE == ipv4_address_number) {
@@ -75,29 +101,22 @@ static bool socketAddressFromString(const char *const socket_address_string,
 	// Succesfully converted ipv4 address
 	*ipv4_address = ntohl(ipv4_address_number);
 
-	char port_string[sizeof("65535")] = {0};
-	const uint8_t j = colon_position + 1;
-
-	// Get port number
-	for(int i = 0; i < sizeof(port_string); i++) {
-		char c = socket_address_string[j + i];
-
-		if (c == '\0') {
-			port_string[i] = '\0';
-			break;
-		}
-
-		port_string[i] = c;
+	// Convert port directly from source string, so port length is not limited by any buffer
+	const char *const port_string = &socket_address_string[colon_position + 1];
+	if ((*port_string < '0') || (*port_string > '9')) {
+		// Port has to start with digit (no sign or whitespace allowed)
+		return false;
 	}
 
 	char *port_string_last_char;
-	uint16_t port_number = (uint16_t)strtol(port_string, &port_string_last_char, 10);
-	if (*port_string_last_char != '\0') {
+	errno = 0;
+	const unsigned long port_number = strtoul(port_string, &port_string_last_char, 10);
+	if ((*port_string_last_char != '\0') || (0 != errno) || (UINT16_MAX < port_number)) {
 		// Failed to convert port_string into number
 		return false;
 	}
 	// Succesfully converted port
-	*port = port_number;
+	*port = (uint16_t)port_number;
 
 	return true;
 }
@@ -112,22 +131,47 @@ static inline void copyConfig(struct virtualLinkObject *const object,
 	object->_config = *config;
 }
 
-static inline int initTxSocket(const struct sockaddr_in *const tx_socket_address) {
+static inline void closeFileDescriptor(int fd) {
+	if (-1 != fd) {
+		close(fd);
+	}
+}
+
+static inline bool setSocketPriority(int socket_fd, int socket_priority) {
+	if (0 == socket_priority) {
+		// Default priority requested - nothing to do
+		return true;
+	}
+
+	const int ret = setsockopt(socket_fd,
+				   SOL_SOCKET,
+				   SO_PRIORITY,
+				   &socket_priority, sizeof(socket_priority));
+	return -1 != ret;
+}
+
+static inline int initTxSocket(const struct sockaddr_in *const tx_socket_address,
+			       uint8_t dscp, int socket_priority) {
 	assert((NULL != tx_socket_address)
 	       && "socket_address cannot be NULL");
 
 	// Create new socket
 	const int new_socket_fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-	assert((-1 != new_socket_fd)
-	       && "Failed to create socket");
+	if (-1 == new_socket_fd) {
+		// Failed to create socket
+		return -1;
+	}
 
 	// Permit sending multicast messages on socket
 	int ret = setsockopt(new_socket_fd,
 			     IPPROTO_IP,
 			     IP_MULTICAST_IF,
 			     &tx_socket_address->sin_addr, sizeof(struct in_addr));
-	assert((-1 != ret)
-	       && "Failed to set IP_MULTICAST_IF option");
+	if (-1 == ret) {
+		// Failed to set IP_MULTICAST_IF option
+		close(new_socket_fd);
+		return -1;
+	}
 
 	//Enable multicast looping - transmited message will be delivered also to sending host
 	const int one = 1;
@@ -135,27 +179,56 @@ static inline int initTxSocket(const struct sockaddr_in *const tx_socket_address
 			 IPPROTO_IP,
 			 IP_MULTICAST_LOOP,
 			 &one, sizeof(one));
-	assert((-1 != ret)
-	       && "Failed to set IP_MULTICAST_LOOP option");
+	if (-1 == ret) {
+		// Failed to set IP_MULTICAST_LOOP option
+		close(new_socket_fd);
+		return -1;
+	}
+
+	// Mark transmitted packets with DSCP (upper 6 bits of TOS field)
+	if (0 != dscp) {
+		const int tos = (int)(dscp << 2);
+		ret = setsockopt(new_socket_fd,
+				 IPPROTO_IP,
+				 IP_TOS,
+				 &tos, sizeof(tos));
+		if (-1 == ret) {
+			// Failed to set IP_TOS option
+			close(new_socket_fd);
+			return -1;
+		}
+	}
+
+	if (!setSocketPriority(new_socket_fd, socket_priority)) {
+		// Failed to set SO_PRIORITY option
+		close(new_socket_fd);
+		return -1;
+	}
 
 	// Bind socket with address
     	ret = bind(new_socket_fd,
 		   (struct sockaddr *)tx_socket_address, sizeof(struct sockaddr_in));
-	assert((-1 != ret)
-	       && "Failed to bind socket");
+	if (-1 == ret) {
+		// Failed to bind socket
+		close(new_socket_fd);
+		return -1;
+	}
 
 	// Succesfully initialized tx socket
 	return new_socket_fd;
 }
 
-static inline int initRxSocket(const struct sockaddr_in *const rx_socket_address) {
+static inline int initRxSocket(const struct sockaddr_in *const rx_socket_address,
+			       int socket_priority) {
 	assert((NULL != rx_socket_address)
 	       && "socket_address cannot be NULL");
 
 	// Create new socket
 	const int new_socket_fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-	assert((-1 != new_socket_fd)
-	       && "Failed to create socket");
+	if (-1 == new_socket_fd) {
+		// Failed to create socket
+		return -1;
+	}
 
 	// Enable address reusing
 	const int one = 1;
@@ -163,35 +236,47 @@ static inline int initRxSocket(const struct sockaddr_in *const rx_socket_address
 			     SOL_SOCKET,
 			     SO_REUSEADDR,
 			     &one, sizeof(one));
-	assert((-1 != ret)
-	       && "Failed to set SO_REUSEADDR option");
+	if (-1 == ret) {
+		// Failed to set SO_REUSEADDR option
+		close(new_socket_fd);
+		return -1;
+	}
 
 	// Enable port reusing
 	ret = setsockopt(new_socket_fd,
 			 SOL_SOCKET,
 			 SO_REUSEPORT,
 			 &one, sizeof(one));
-	assert((-1 != ret)
-	       && "Failed to set SO_REUSEPORT option");
+	if (-1 == ret) {
+		// Failed to set SO_REUSEPORT option
+		close(new_socket_fd);
+		return -1;
+	}
+
+	if (!setSocketPriority(new_socket_fd, socket_priority)) {
+		// Failed to set SO_PRIORITY option
+		close(new_socket_fd);
+		return -1;
+	}
 
 	// Bind socket with address
     	ret = bind(new_socket_fd,
 		   (struct sockaddr *)rx_socket_address, sizeof(struct sockaddr_in));
-	assert((-1 != ret)
-	       && "Failed to bind socket");
+	if (-1 == ret) {
+		// Failed to bind socket
+		close(new_socket_fd);
+		return -1;
+	}
 
 	// Succesfully initialized rx socket
 	return new_socket_fd;
 }
 
 static inline int createEpoll(void) {
-	const int epoll_fd = epoll_create1(0);
-	assert((-1 != epoll_fd)
-		&& "Failed to create epoll file desciptor");
-	return epoll_fd;
+	return epoll_create1(0);
 }
 
-static inline void addObservableFileDescriptor(int epoll_fd,
+static inline bool addObservableFileDescriptor(int epoll_fd,
 					       int observable_fd, int events) {
 	struct epoll_event event = {
 		.events = events,
@@ -199,11 +284,10 @@ static inline void addObservableFileDescriptor(int epoll_fd,
 	};
 
 	const int err = epoll_ctl(epoll_fd, EPOLL_CTL_ADD, observable_fd, &event);
-	assert((0 == err)
-	       && "Failed to add file descriptor as epoll event");
+	return 0 == err;
 }
 
-static inline void attachSocketToMulticastGroup(int socket_fd,
+static inline bool attachSocketToMulticastGroup(int socket_fd,
 						uint32_t ipv4_interface_address,
 						uint32_t ipv4_multicast_group_address) {
 	const struct ip_mreq mreq = {
@@ -215,8 +299,7 @@ static inline void attachSocketToMulticastGroup(int socket_fd,
 				   IPPROTO_IP,
 				   IP_ADD_MEMBERSHIP,
 				   &mreq, sizeof(mreq));
-	assert((-1 != ret)
-	       && "Failed to set IP_ADD_MEMBERSHIP option");
+	return -1 != ret;
 }
 
 static inline bool compareSocketAddress(const struct virtualLinkSocketAddress *const a,
@@ -251,30 +334,134 @@ callRxDoneCallback(const struct virtualLinkObject *const object,
 	assert((object->_is_initialized)
 	       && "object has to be initialized");
 
-	if (NULL == object->_rx_done_callback.function) {
+	if (NULL != object->_rx_done_callback.function) {
 		object->_rx_done_callback.function(rx_data, rx_data_size,
 						   originator_address,
 						   object->_rx_done_callback.user_data);
 	}
 }
 
+static inline int64_t getMonotonicTimeNs(void) {
+	struct timespec now;
+	const int ret = clock_gettime(CLOCK_MONOTONIC, &now);
+	assert((0 == ret)
+	       && "Failed to get monotonic time");
+
+	return ((int64_t)now.tv_sec * NS_IN_S) + (int64_t)now.tv_nsec;
+}
+
+static inline bool hasRxSocketEvent(const struct virtualLinkObject *const object,
+				    const struct epoll_event *const events, int events_count) {
+	for (int i = 0; i < events_count; i++) {
+		if (object->_rx_socket_fd == events[i].data.fd) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static inline void armTimer(const struct virtualLinkObject *const object, int64_t timeout_ns) {
+	// Zero timeout disarms timer and clears its expirations
+	const struct itimerspec timer_value = {
+		.it_value.tv_sec = timeout_ns / NS_IN_S,
+		.it_value.tv_nsec = timeout_ns % NS_IN_S,
+	};
+
+	const int ret = timerfd_settime(object->_timer_fd, 0, &timer_value, NULL);
+	assert((0 == ret)
+	       && "Failed to set timer");
+}
+
+static inline int waitForEpollEvents(const struct virtualLinkObject *const object,
+				     struct epoll_event *const events, int max_events,
+				     int64_t timeout_ns) {
+#ifdef VIRTUAL_LINK_HAS_EPOLL_PWAIT2
+	// epoll_pwait2() is missing on kernels older than 5.11, remember it after first ENOSYS
+	static bool is_epoll_pwait2_supported = true;
+
+	if (__atomic_load_n(&is_epoll_pwait2_supported, __ATOMIC_RELAXED)) {
+		// Wait with nanosecond resolution, negative timeout means wait forever
+		const struct timespec timeout = {
+			.tv_sec = timeout_ns / NS_IN_S,
+			.tv_nsec = timeout_ns % NS_IN_S,
+		};
+		const int ret = epoll_pwait2(object->_epoll_descriptor, events, max_events,
+					     (0 > timeout_ns) ? NULL : &timeout, NULL);
+		if ((-1 != ret) || (ENOSYS != errno)) {
+			return ret;
+		}
+
+		__atomic_store_n(&is_epoll_pwait2_supported, false, __ATOMIC_RELAXED);
+	}
+#endif
+	if ((0 < timeout_ns) && (0 != (timeout_ns % NS_IN_MS))) {
+		// No epoll_pwait2() and timeout not representable in miliseconds - let timer wake us
+		armTimer(object, timeout_ns);
+		const int ret = epoll_wait(object->_epoll_descriptor, events, max_events, -1);
+		const int saved_errno = errno;
+		armTimer(object, 0);
+		errno = saved_errno;
+
+		return ret;
+	}
+
+	int timeout_ms = -1;
+	if (0 <= timeout_ns) {
+		const int64_t timeout_ms_full = timeout_ns / NS_IN_MS;
+		timeout_ms = (INT_MAX < timeout_ms_full) ? INT_MAX : (int)timeout_ms_full;
+	}
+
+	return epoll_wait(object->_epoll_descriptor, events, max_events, timeout_ms);
+}
+
 static inline bool isRxDataAwaiting(const struct virtualLinkObject *const object,
-				    int timeout_ms) {
+				    int64_t timeout_ns) {
 	assert((NULL != object)
 	       && "object cannot be NULL");
 	assert((object->_is_initialized)
 	       && "object has to be initialized");
 
-	struct epoll_event event;
-	const int ret = epoll_wait(object->_epoll_descriptor, &event, 1, timeout_ms);
+	// Room for both rx socket and timer events
+	struct epoll_event events[2];
+	const int ret = waitForEpollEvents(object, events, 2, timeout_ns);
+	if ((-1 == ret) && (EINTR == errno)) {
+		// Interrupted by signal - let caller recalculate remaining time
+		return false;
+	}
+
 	assert((0 <= ret)
 	       && "Failed to get count of epoll events");
-	return 1 <= ret;
+	return hasRxSocketEvent(object, events, ret);
 }
 
-static inline size_t receiveData(const struct virtualLinkObject *const object,
-				 void *const rx_buffer, size_t rx_bytes_read_size, 
-				 struct virtualLinkSocketAddress *const originator_address) {
+static inline uint32_t readIntegrityTrailer(const uint8_t *const rx_buffer,
+					    size_t rx_buffer_size,
+					    const uint8_t *const rx_tail,
+					    size_t trailer_offset) {
+	// Trailer may be split between rx buffer and rx tail
+	uint8_t trailer[VIRTUAL_LINK_INTEGRITY_TRAILER_SIZE];
+	for (size_t i = 0; i < sizeof(trailer); i++) {
+		const size_t position = trailer_offset + i;
+		trailer[i] = (position < rx_buffer_size) ? rx_buffer[position]
+							 : rx_tail[position - rx_buffer_size];
+	}
+
+	uint32_t crc;
+	memcpy(&crc, trailer, sizeof(crc));
+	return ntohl(crc);
+}
+
+static inline void countIntegrityFailure(const struct virtualLinkObject *const object) {
+	// Statistics are updated also from const API - objects are required to be non-const,
+	// see struct virtualLinkObject
+	struct virtualLinkObject *const mutable_object = (struct virtualLinkObject *)object;
+	__atomic_fetch_add(&mutable_object->_integrity_failures_count, 1, __ATOMIC_RELAXED);
+}
+
+static inline ssize_t receiveData(const struct virtualLinkObject *const object,
+				  void *const rx_buffer, size_t rx_bytes_read_size, int flags,
+				  struct virtualLinkSocketAddress *const originator_address) {
 	assert((NULL != object)
 	       && "object cannot be NULL");
 	assert((object->_is_initialized)
@@ -283,16 +470,30 @@ static inline size_t receiveData(const struct virtualLinkObject *const object,
 	       && "object cannot be NULL");
 
 	struct sockaddr_in originator_address_tmp1;
-	socklen_t originator_address_size = sizeof(originator_address_tmp1);
+	const bool is_integrity_trailer_enabled = object->_config.is_integrity_trailer_enabled;
+
+	// Trailer lands in rx buffer or, for full-sized packets, in rx tail
+	uint8_t rx_tail[VIRTUAL_LINK_INTEGRITY_TRAILER_SIZE];
+	struct iovec rx_iov[] = {
+		{ .iov_base = rx_buffer, .iov_len = rx_bytes_read_size },
+		{ .iov_base = rx_tail, .iov_len = sizeof(rx_tail) },
+	};
+	struct msghdr rx_message = {
+		.msg_name = &originator_address_tmp1,
+		.msg_namelen = sizeof(originator_address_tmp1),
+		.msg_iov = rx_iov,
+		.msg_iovlen = is_integrity_trailer_enabled ? 2 : 1,
+	};
 
 	// Receive data from soscket
-	const ssize_t rx_size = recvfrom(object->_rx_socket_fd,
-					 rx_buffer, rx_bytes_read_size,
-			   		 0,
-					 (struct sockaddr *)&originator_address_tmp1,
-					 &originator_address_size);
+	const ssize_t rx_size = recvmsg(object->_rx_socket_fd, &rx_message, flags);
 
-	// Catch recvfrom errors
+	// Nothing to receive in non-blocking mode
+	if ((-1 == rx_size) && ((EAGAIN == errno) || (EWOULDBLOCK == errno))) {
+		return -1;
+	}
+
+	// Catch recvmsg errors
 	assert((0 <= rx_size)
 	       && "Failed to receive packet from socket");
 
@@ -307,12 +508,31 @@ static inline size_t receiveData(const struct virtualLinkObject *const object,
 		return 0;
 	}
 
+	size_t rx_data_size = (size_t)rx_size;
+
+	// Verify and strip integrity trailer, drop corrupted or truncated packets
+	if (is_integrity_trailer_enabled) {
+		if ((rx_data_size < VIRTUAL_LINK_INTEGRITY_TRAILER_SIZE)
+		    || (0 != (rx_message.msg_flags & MSG_TRUNC))) {
+			countIntegrityFailure(object);
+			return 0;
+		}
+
+		rx_data_size -= VIRTUAL_LINK_INTEGRITY_TRAILER_SIZE;
+		const uint32_t received_crc = readIntegrityTrailer(rx_buffer, rx_bytes_read_size,
+								   rx_tail, rx_data_size);
+		if (received_crc != crc32c_calculate(rx_buffer, rx_data_size)) {
+			countIntegrityFailure(object);
+			return 0;
+		}
+	}
+
 	// Not self-transmitted packet - update originator address
 	if (NULL != originator_address) {
 		*originator_address = originator_address_tmp2;
 	}
 
-	return (size_t)rx_size;
+	return (ssize_t)rx_data_size;
 }
 
 static void *rxProcessingThread(void *arg) {
@@ -326,11 +546,11 @@ static void *rxProcessingThread(void *arg) {
 
 	while (true) {
 		// Wait for data
-		int16_t read_size = virtualLink_receiveDataBlocking(object,
-								    object->_config.rx_buffer,
-								    object->_config.rx_buffer_size,
-								    VIRTUAL_LINK_WAIT_FOREVER,
-								    &originator_address);
+		int16_t read_size = virtualLink_receiveDataBlockingNs(object,
+								      object->_config.rx_buffer,
+								      object->_config.rx_buffer_size,
+								      VIRTUAL_LINK_WAIT_FOREVER,
+								      &originator_address);
 
 		if (isRxInterruptEnabled(object) && (read_size > 0)) {
 			callRxDoneCallback(object,
@@ -340,6 +560,146 @@ static void *rxProcessingThread(void *arg) {
 	}
 }
 
+static void *rxPrioritizedProcessingThread(void *arg) {
+	const struct virtualLinkLanes *const lanes = arg;
+	assert((NULL != lanes)
+	       && "lanes cannot be NULL");
+
+	struct epoll_event event;
+
+	while (true) {
+		// Wait until any of lanes has data
+		const int ret = epoll_wait(lanes->_epoll_descriptor, &event, 1, -1);
+		if ((-1 == ret) && (EINTR == errno)) {
+			continue;
+		}
+		assert((0 <= ret)
+		       && "Failed to get count of epoll events");
+
+		virtualLink_Meta_prioritizedProcessingLoop(lanes);
+	}
+}
+
+static inline bool isBlankOrCommentLine(const char *line) {
+	while ((' ' == *line) || ('\t' == *line)) {
+		line++;
+	}
+
+	return ('\0' == *line) || ('\n' == *line) || ('\r' == *line) || ('#' == *line);
+}
+
+static bool parseLongInRange(const char *const string, long min, long max, long *const value) {
+	char *string_last_char;
+	const long number = strtol(string, &string_last_char, 10);
+	if ((*string_last_char != '\0') || (string_last_char == string)
+	    || (min > number) || (max < number)) {
+		return false;
+	}
+
+	*value = number;
+	return true;
+}
+
+static enum virtualLinkStatus configFromLine(struct virtualLinkConfig *const config,
+					     char *const line) {
+	static const char delimiters[] = " \t\r\n";
+	char *save_pointer;
+
+	// Mandatory fields: interface, tx socket address and rx socket address
+	const char *const interface_ipv4_address_string = strtok_r(line, delimiters, &save_pointer);
+	const char *const tx_socket_address_string = strtok_r(NULL, delimiters, &save_pointer);
+	const char *const rx_socket_address_string = strtok_r(NULL, delimiters, &save_pointer);
+	if (NULL == rx_socket_address_string) {
+		return VIRTUAL_LINK_STATUS_INVALID_CONFIG;
+	}
+
+	const bool ret = virtualLink_configFromStrings(config,
+						       interface_ipv4_address_string,
+						       tx_socket_address_string,
+						       rx_socket_address_string);
+	if (!ret) {
+		return VIRTUAL_LINK_STATUS_INVALID_CONFIG;
+	}
+
+	config->rx_buffer = NULL;
+	config->rx_buffer_size = 0;
+
+	// Optional fields: dscp=<0-63>, priority=<number>, integrity
+	const char *option;
+	while (NULL != (option = strtok_r(NULL, delimiters, &save_pointer))) {
+		long value;
+
+		if (0 == strncmp(option, "dscp=", strlen("dscp="))) {
+			if (!parseLongInRange(option + strlen("dscp="), 0, 63, &value)) {
+				return VIRTUAL_LINK_STATUS_INVALID_CONFIG;
+			}
+			config->dscp = (uint8_t)value;
+		} else if (0 == strncmp(option, "priority=", strlen("priority="))) {
+			if (!parseLongInRange(option + strlen("priority="), 0, INT_MAX, &value)) {
+				return VIRTUAL_LINK_STATUS_INVALID_CONFIG;
+			}
+			config->socket_priority = (int)value;
+		} else if (0 == strcmp(option, "integrity")) {
+			config->is_integrity_trailer_enabled = true;
+		} else {
+			// Unknown option
+			return VIRTUAL_LINK_STATUS_INVALID_CONFIG;
+		}
+	}
+
+	return VIRTUAL_LINK_STATUS_OK;
+}
+
+static bool isTxSocketAddressDuplicated(const struct virtualLinkConfig *const configs,
+					const enum virtualLinkStatus *const statuses,
+					size_t config_index) {
+	for (size_t i = 0; i < config_index; i++) {
+		if ((VIRTUAL_LINK_STATUS_OK == statuses[i])
+		    && compareSocketAddress(&configs[i].tx_socket_address,
+					    &configs[config_index].tx_socket_address)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+struct initManyContext {
+	struct virtualLinkObject *objects;
+	const struct virtualLinkConfig *configs;
+	const enum virtualLinkStatus *validation_statuses;
+	enum virtualLinkStatus *statuses;
+	size_t objects_count;
+	size_t next_index;
+};
+
+static void *initManyWorker(void *arg) {
+	struct initManyContext *const context = arg;
+	assert((NULL != context)
+	       && "context cannot be NULL");
+
+	while (true) {
+		// Take next link to initialize
+		const size_t i = __atomic_fetch_add(&context->next_index, 1, __ATOMIC_RELAXED);
+		if (i >= context->objects_count) {
+			break;
+		}
+
+		// Skip links already rejected during validation
+		if ((NULL != context->validation_statuses)
+		    && (VIRTUAL_LINK_STATUS_OK != context->validation_statuses[i])) {
+			context->objects[i]._is_initialized = false;
+			context->statuses[i] = context->validation_statuses[i];
+			continue;
+		}
+
+		context->statuses[i] = virtualLink_tryInit(&context->objects[i],
+							   &context->configs[i]);
+	}
+
+	return NULL;
+}
+
 /* ----------------------------------------- Meta API ------------------------------------------ */
 void virtualLink_Meta_processingLoop(const struct virtualLinkObject *const object) {
 	assert((NULL != object)
@@ -351,14 +711,16 @@ void virtualLink_Meta_processingLoop(const struct virtualLinkObject *const objec
 
 	if (isRxInterruptEnabled(object)) {
 		const int16_t read_size =
-			virtualLink_receiveDataBlocking(object,
-						        object->_config.rx_buffer,
-						        object->_config.rx_buffer_size,
-						        VIRTUAL_LINK_DONT_WAIT,
-							&originator_address);
-		callRxDoneCallback(object,
-				   object->_config.rx_buffer, read_size,
-				   &originator_address);
+			virtualLink_receiveDataBlockingNs(object,
+							  object->_config.rx_buffer,
+							  object->_config.rx_buffer_size,
+							  VIRTUAL_LINK_DONT_WAIT,
+							  &originator_address);
+		if (0 < read_size) {
+			callRxDoneCallback(object,
+					   object->_config.rx_buffer, read_size,
+					   &originator_address);
+		}
 	}
 }
 
@@ -367,6 +729,44 @@ void virtualLink_Meta_runProcessingThread(const struct virtualLinkObject *const
 	pthread_create(&thread, NULL, rxProcessingThread, (void*)object);
 }
 
+void virtualLink_Meta_prioritizedProcessingLoop(const struct virtualLinkLanes *const lanes) {
+	assert((NULL != lanes)
+	       && "lanes cannot be NULL");
+	assert((NULL != lanes->objects)
+	       && "lanes->objects cannot be NULL");
+	assert((0 < lanes->budget_per_lane)
+	       && "lanes->budget_per_lane has to be greater than 0");
+
+	// Higher priority lanes go first, so their packets never wait behind bulk traffic
+	for (size_t i = 0; i < lanes->objects_count; i++) {
+		virtualLink_drain(lanes->objects[i], lanes->budget_per_lane);
+	}
+}
+
+void virtualLink_Meta_runPrioritizedProcessingThread(struct virtualLinkLanes *const lanes) {
+	assert((NULL != lanes)
+	       && "lanes cannot be NULL");
+	assert((NULL != lanes->objects)
+	       && "lanes->objects cannot be NULL");
+	assert((0 < lanes->budget_per_lane)
+	       && "lanes->budget_per_lane has to be greater than 0");
+
+	// Observe epolls of all lanes with single epoll
+	lanes->_epoll_descriptor = createEpoll();
+	assert((-1 != lanes->_epoll_descriptor)
+	       && "Failed to create epoll file desciptor");
+	for (size_t i = 0; i < lanes->objects_count; i++) {
+		const bool ret = addObservableFileDescriptor(lanes->_epoll_descriptor,
+							     lanes->objects[i]->_epoll_descriptor,
+							     EPOLLIN);
+		assert(ret
+		       && "Failed to add file descriptor as epoll event");
+	}
+
+	pthread_t thread;
+	pthread_create(&thread, NULL, rxPrioritizedProcessingThread, (void*)lanes);
+}
+
 /* -------------------------------------------- API -------------------------------------------- */
 bool virtualLink_configFromStrings(struct virtualLinkConfig *const config,
 				   const char *const interface_ipv4_address_string,
@@ -390,6 +790,13 @@ bool virtualLink_configFromStrings(struct virtualLinkConfig *const config,
 	}
 	config->interface_ipv4_address = ntohl(interface_ipv4_address_number);
 
+	// No QoS by default
+	config->dscp = 0;
+	config->socket_priority = 0;
+
+	// No integrity trailer by default
+	config->is_integrity_trailer_enabled = false;
+
 	// Convert tx socket address
 	bool ret = socketAddressFromString(tx_socket_address_string,
 					   &config->tx_socket_address.ipv4_address,
@@ -407,13 +814,14 @@ bool virtualLink_configFromStrings(struct virtualLinkConfig *const config,
 	return ret;
 }
 
-void virtualLink_init(struct virtualLinkObject *const object,
-		      const struct virtualLinkConfig *const config) {
+enum virtualLinkStatus virtualLink_tryInit(struct virtualLinkObject *const object,
+					   const struct virtualLinkConfig *const config) {
 	assert((NULL != object)
 	       && "object cannot be NULL");
 	assert((NULL != config)
 	       && "config cannot be NULL");
 
+	object->_is_initialized = false;
 	copyConfig(object, config);
 
 	// Create tx socket
@@ -423,7 +831,12 @@ void virtualLink_init(struct virtualLinkObject *const object,
 		.sin_port = htons(object->_config.tx_socket_address.port),
 	};
 
-	object->_tx_socket_fd = initTxSocket(&tx_socket_address);
+	object->_tx_socket_fd = initTxSocket(&tx_socket_address,
+					     object->_config.dscp,
+					     object->_config.socket_priority);
+	if (-1 == object->_tx_socket_fd) {
+		return VIRTUAL_LINK_STATUS_TX_SOCKET_FAILED;
+	}
 
 	// Create rx socket
 	const struct sockaddr_in rx_socket_address = {
@@ -432,22 +845,166 @@ void virtualLink_init(struct virtualLinkObject *const object,
 		.sin_port = htons(object->_config.rx_socket_address.port),
 	};
 
-	object->_rx_socket_fd = initRxSocket(&rx_socket_address);
+	object->_rx_socket_fd = initRxSocket(&rx_socket_address,
+					     object->_config.socket_priority);
+	if (-1 == object->_rx_socket_fd) {
+		closeFileDescriptor(object->_tx_socket_fd);
+		return VIRTUAL_LINK_STATUS_RX_SOCKET_FAILED;
+	}
 
 	// Create epoll and add rx socket as observable
 	object->_epoll_descriptor = createEpoll();
-	addObservableFileDescriptor(object->_epoll_descriptor, object->_rx_socket_fd, EPOLLIN);
+	if ((-1 == object->_epoll_descriptor)
+	    || !addObservableFileDescriptor(object->_epoll_descriptor,
+					    object->_rx_socket_fd, EPOLLIN)) {
+		closeFileDescriptor(object->_epoll_descriptor);
+		closeFileDescriptor(object->_rx_socket_fd);
+		closeFileDescriptor(object->_tx_socket_fd);
+		return VIRTUAL_LINK_STATUS_EPOLL_FAILED;
+	}
+
+	// Create timer for sub-milisecond timeouts when epoll_pwait2() is not available
+	object->_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if ((-1 == object->_timer_fd)
+	    || !addObservableFileDescriptor(object->_epoll_descriptor,
+					    object->_timer_fd, EPOLLIN)) {
+		closeFileDescriptor(object->_timer_fd);
+		closeFileDescriptor(object->_epoll_descriptor);
+		closeFileDescriptor(object->_rx_socket_fd);
+		closeFileDescriptor(object->_tx_socket_fd);
+		return VIRTUAL_LINK_STATUS_TIMER_FAILED;
+	}
 
 	// Attach rx socket to multicast group
 	const uint32_t interface_ipv4_address = htonl(object->_config.interface_ipv4_address);
-	attachSocketToMulticastGroup(object->_rx_socket_fd,
-				     interface_ipv4_address,
-				     (uint32_t)rx_socket_address.sin_addr.s_addr);
+	const bool is_attached =
+		attachSocketToMulticastGroup(object->_rx_socket_fd,
+					     interface_ipv4_address,
+					     (uint32_t)rx_socket_address.sin_addr.s_addr);
+	if (!is_attached) {
+		closeFileDescriptor(object->_timer_fd);
+		closeFileDescriptor(object->_epoll_descriptor);
+		closeFileDescriptor(object->_rx_socket_fd);
+		closeFileDescriptor(object->_tx_socket_fd);
+		return VIRTUAL_LINK_STATUS_MULTICAST_JOIN_FAILED;
+	}
 
 	object->_is_rx_interrupt_enabled = false;
 	object->_rx_done_callback.function = NULL;
+	object->_integrity_failures_count = 0;
 
 	object->_is_initialized = true;
+
+	return VIRTUAL_LINK_STATUS_OK;
+}
+
+void virtualLink_init(struct virtualLinkObject *const object,
+		      const struct virtualLinkConfig *const config) {
+	const enum virtualLinkStatus status = virtualLink_tryInit(object, config);
+	assert((VIRTUAL_LINK_STATUS_OK == status)
+	       && "Failed to init virtualLink object");
+}
+
+bool virtualLink_loadConfigsFromFile(const char *const path,
+				     struct virtualLinkConfig *const configs,
+				     enum virtualLinkStatus *const statuses,
+				     size_t configs_max_count,
+				     size_t *const configs_count) {
+	assert((NULL != path)
+	       && "path cannot be NULL");
+	assert((NULL != configs)
+	       && "configs cannot be NULL");
+	assert((NULL != statuses)
+	       && "statuses cannot be NULL");
+	assert((NULL != configs_count)
+	       && "configs_count cannot be NULL");
+
+	*configs_count = 0;
+
+	FILE *const file = fopen(path, "r");
+	if (NULL == file) {
+		// Failed to open config file
+		return false;
+	}
+
+	char *line = NULL;
+	size_t line_size = 0;
+	bool ret = true;
+
+	while (-1 != getline(&line, &line_size, file)) {
+		if (isBlankOrCommentLine(line)) {
+			continue;
+		}
+
+		if (*configs_count >= configs_max_count) {
+			// More links in file than provided configs
+			ret = false;
+			break;
+		}
+
+		const size_t i = (*configs_count)++;
+		statuses[i] = configFromLine(&configs[i], line);
+
+		// TX socket can be bound only once - reject later duplicates up front
+		if ((VIRTUAL_LINK_STATUS_OK == statuses[i])
+		    && isTxSocketAddressDuplicated(configs, statuses, i)) {
+			statuses[i] = VIRTUAL_LINK_STATUS_INVALID_CONFIG;
+		}
+	}
+
+	free(line);
+	fclose(file);
+
+	return ret;
+}
+
+void virtualLink_initMany(struct virtualLinkObject *const objects,
+			  const struct virtualLinkConfig *const configs,
+			  const enum virtualLinkStatus *const validation_statuses,
+			  enum virtualLinkStatus *const statuses,
+			  size_t objects_count,
+			  size_t threads_count) {
+	assert((NULL != objects)
+	       && "objects cannot be NULL");
+	assert((NULL != configs)
+	       && "configs cannot be NULL");
+	assert((NULL != statuses)
+	       && "statuses cannot be NULL");
+
+	struct initManyContext context = {
+		.objects = objects,
+		.configs = configs,
+		.validation_statuses = validation_statuses,
+		.statuses = statuses,
+		.objects_count = objects_count,
+		.next_index = 0,
+	};
+
+	// Calling thread is one of workers
+	if (threads_count > VIRTUAL_LINK_INIT_MANY_MAX_THREADS) {
+		threads_count = VIRTUAL_LINK_INIT_MANY_MAX_THREADS;
+	}
+	if (threads_count > objects_count) {
+		threads_count = objects_count;
+	}
+
+	pthread_t threads[VIRTUAL_LINK_INIT_MANY_MAX_THREADS];
+	size_t started_threads_count = 0;
+
+	for (size_t i = 1; i < threads_count; i++) {
+		if (0 != pthread_create(&threads[started_threads_count], NULL,
+					initManyWorker, &context)) {
+			// Remaining links will be initialized by already running workers
+			break;
+		}
+		started_threads_count++;
+	}
+
+	initManyWorker(&context);
+
+	for (size_t i = 0; i < started_threads_count; i++) {
+		pthread_join(threads[i], NULL);
+	}
 }
 
 size_t virtualLink_sendDataBlocking(const struct virtualLinkObject *const object,
@@ -465,48 +1022,87 @@ size_t virtualLink_sendDataBlocking(const struct virtualLinkObject *const object
 		.sin_port = htons(object->_config.rx_socket_address.port),
 	};
 
-	const ssize_t tx_size = sendto(object->_tx_socket_fd,
-				       tx_data, tx_data_size,
-				       0,
-				       (struct sockaddr *)&destination_address,
-			      	       sizeof(struct sockaddr_in));
-	assert((0 <= tx_size )
+	if (!object->_config.is_integrity_trailer_enabled) {
+		const ssize_t tx_size = sendto(object->_tx_socket_fd,
+					       tx_data, tx_data_size,
+					       0,
+					       (struct sockaddr *)&destination_address,
+					       sizeof(struct sockaddr_in));
+		assert((0 <= tx_size )
+		       && "Failed to send data");
+
+		return (size_t)tx_size;
+	}
+
+	// Append integrity trailer without copying tx data
+	const uint32_t crc = htonl(crc32c_calculate(tx_data, tx_data_size));
+	struct iovec tx_iov[] = {
+		{ .iov_base = (void *)tx_data, .iov_len = tx_data_size },
+		{ .iov_base = (void *)&crc, .iov_len = sizeof(crc) },
+	};
+	const struct msghdr tx_message = {
+		.msg_name = (void *)&destination_address,
+		.msg_namelen = sizeof(struct sockaddr_in),
+		.msg_iov = tx_iov,
+		.msg_iovlen = 2,
+	};
+
+	const ssize_t tx_size = sendmsg(object->_tx_socket_fd, &tx_message, 0);
+	assert((0 <= tx_size)
 	       && "Failed to send data");
-	
-	return (size_t)tx_size;
+	assert((VIRTUAL_LINK_INTEGRITY_TRAILER_SIZE <= (size_t)tx_size)
+	       && "Failed to send integrity trailer");
+
+	return (size_t)tx_size - VIRTUAL_LINK_INTEGRITY_TRAILER_SIZE;
 }
 
 size_t virtualLink_receiveDataBlocking(const struct virtualLinkObject *const object,
 				       void *const rx_buffer, size_t rx_bytes_read_size,
 				       int timeout_ms,
 				       struct virtualLinkSocketAddress *const originator_address) {
+	const int64_t timeout_ns = (0 > timeout_ms) ? VIRTUAL_LINK_WAIT_FOREVER
+						    : (int64_t)timeout_ms * NS_IN_MS;
+
+	return virtualLink_receiveDataBlockingNs(object,
+						 rx_buffer, rx_bytes_read_size,
+						 timeout_ns,
+						 originator_address);
+}
+
+size_t virtualLink_receiveDataBlockingNs(const struct virtualLinkObject *const object,
+					 void *const rx_buffer, size_t rx_bytes_read_size,
+					 int64_t timeout_ns,
+					 struct virtualLinkSocketAddress *const originator_address) {
 	assert((NULL != object)
 	       && "object cannot be NULL");
 	assert((object->_is_initialized)
 	       && "object has to be initialized");
 
-	const uint32_t start_timestamp = systemTime_getFreezableEpochMs();
+	// Clamp deadline, so very long timeouts do not overflow
+	const int64_t now_ns = getMonotonicTimeNs();
+	const int64_t deadline_ns = (timeout_ns > (INT64_MAX - now_ns)) ? INT64_MAX
+									: (now_ns + timeout_ns);
+	int64_t wait_time_ns = timeout_ns;
 
 	while (true) {
-		if (isRxDataAwaiting(object, 0)) {
-			const size_t rx_size = receiveData(object,
-							   rx_buffer, rx_bytes_read_size,
-							   originator_address);
+		if (isRxDataAwaiting(object, wait_time_ns)) {
+			const ssize_t rx_size = receiveData(object,
+							    rx_buffer, rx_bytes_read_size, 0,
+							    originator_address);
 			assert((0 <= rx_size)
 	       		       && "Failed to receive packet from socket");
 			
-			return rx_size;
+			return (size_t)rx_size;
 		}
 
-		if (0 == timeout_ms) {
-			break;
+		if (0 > timeout_ns) {
+			continue;
 		}
 
-		if (0 < timeout_ms) {
-			const uint32_t delta_time = systemTime_getFreezableEpochMs() - start_timestamp;
-			if (delta_time >= timeout_ms) {
-				break;
-			}
+		// Recalculate remaining time against the same monotonic deadline
+		wait_time_ns = deadline_ns - getMonotonicTimeNs();
+		if (0 >= wait_time_ns) {
+			break;
 		}
 	}
 
@@ -533,3 +1129,54 @@ void virtualLink_registerRxDoneCallback(struct virtualLinkObject *const object,
 	object->_rx_done_callback.function = function;
 	object->_rx_done_callback.user_data = user_data;
 }
+
+uint32_t virtualLink_getIntegrityFailuresCount(const struct virtualLinkObject *const object) {
+	assert((NULL != object)
+	       && "object cannot be NULL");
+	assert((object->_is_initialized)
+	       && "object has to be initialized");
+
+	return __atomic_load_n(&object->_integrity_failures_count, __ATOMIC_RELAXED);
+}
+
+int virtualLink_getPollFd(const struct virtualLinkObject *const object) {
+	assert((NULL != object)
+	       && "object cannot be NULL");
+	assert((object->_is_initialized)
+	       && "object has to be initialized");
+
+	return object->_epoll_descriptor;
+}
+
+size_t virtualLink_drain(const struct virtualLinkObject *const object, size_t budget) {
+	assert((NULL != object)
+	       && "object cannot be NULL");
+	assert((object->_is_initialized)
+	       && "object has to be initialized");
+
+	struct virtualLinkSocketAddress originator_address;
+	size_t processed_count = 0;
+
+	// Read until socket is empty, no readiness check needed between packets.
+	// Packets are consumed even with RX interrupt disabled, so poll fd does not stay readable
+	while (processed_count < budget) {
+		const ssize_t read_size = receiveData(object,
+						      object->_config.rx_buffer,
+						      object->_config.rx_buffer_size,
+						      MSG_DONTWAIT,
+						      &originator_address);
+		if (0 > read_size) {
+			break;
+		}
+
+		if (isRxInterruptEnabled(object) && (0 < read_size)) {
+			callRxDoneCallback(object,
+					   object->_config.rx_buffer, (size_t)read_size,
+					   &originator_address);
+		}
+
+		processed_count++;
+	}
+
+	return processed_count;
+}
@@ -0,0 +1,52 @@
+#include <stdlib.h>
+#include <time.h>
+
+#include "dumbFuzzer.h"
+#include "unity.h"
+
+#include "crc32c.h"
+
+#define CRC32C_CHECK_STRING	"123456789"
+#define CRC32C_CHECK_VALUE	(0xE3069283u)
+
+#define CRC32C_TEST_MAX_DATA_SIZE (1024)
+
+void setUp(void) {
+	time_t t;
+	srand((unsigned) time(&t));
+}
+
+void tearDown(void) {}
+
+/* ------------------------------------------- TESTS ------------------------------------------- */
+void test_knownAnswer(void) {
+	TEST_ASSERT(CRC32C_CHECK_VALUE == crc32c_calculate(CRC32C_CHECK_STRING,
+							   sizeof(CRC32C_CHECK_STRING) - 1));
+	TEST_ASSERT(CRC32C_CHECK_VALUE == crc32c_calculatePortable(CRC32C_CHECK_STRING,
+								   sizeof(CRC32C_CHECK_STRING) - 1));
+	TEST_ASSERT(0 == crc32c_calculate(NULL, 0));
+}
+
+#define TEST_KERNELS_ITERATIONS (1000)
+
+void test_kernelsMatch(void) {
+	static uint8_t sample_data[CRC32C_TEST_MAX_DATA_SIZE + sizeof(uint64_t)];
+
+	for(int i = 0; i < TEST_KERNELS_ITERATIONS; i++) {
+		// Random size and misalignment to cover both bulk and tail processing
+		const uint32_t offset = dumbFuzzer_generateRandomU32InRange(0, sizeof(uint64_t) - 1);
+		const uint32_t data_size =
+			dumbFuzzer_generateRandomU32InRange(0, CRC32C_TEST_MAX_DATA_SIZE);
+		dumbFuzzer_genereteRandomData(&sample_data[offset], data_size);
+
+		TEST_ASSERT(crc32c_calculatePortable(&sample_data[offset], data_size)
+			    == crc32c_calculate(&sample_data[offset], data_size));
+	}
+}
+
+int main(void) {
+	UNITY_BEGIN();
+	RUN_TEST(test_knownAnswer);
+	RUN_TEST(test_kernelsMatch);
+	return UNITY_END();
+}
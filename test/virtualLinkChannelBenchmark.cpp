@@ -0,0 +1,154 @@
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#include "virtualLinkChannel.hpp"
+
+#define VIRTUAL_LINK_INTERFACE_IPV4	"127.0.0.1"
+#define VIRTUAL_LINK_BENCHMARK_TX_IPV4	"127.0.0.1:9080"
+#define VIRTUAL_LINK_BENCHMARK_RX_IPV4	"224.0.0.125:9080"
+
+#define BENCHMARK_LOOPBACK_ITERATIONS	(100000)
+#define BENCHMARK_DISPATCH_ITERATIONS	(100000000)
+
+struct Ping {
+	uint32_t sequence;
+};
+
+struct Pose {
+	double x;
+	double y;
+	double z;
+};
+
+using BenchmarkChannel = virtualLink::Channel<Ping, Pose>;
+
+static int64_t getMonotonicTimeNs(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((int64_t)now.tv_sec * 1000000000LL) + (int64_t)now.tv_nsec;
+}
+
+static void printResult(const char *const name, int64_t elapsed_ns, long iterations) {
+	std::printf("%-24s %8.2f ns/message\n", name, (double)elapsed_ns / (double)iterations);
+}
+
+/* Send and receive Pose over loopback using C API directly */
+static int64_t benchmarkRawLoopback(struct virtualLinkObject *const sender,
+				    struct virtualLinkObject *const receiver) {
+	double checksum = 0.0;
+	const int64_t start_ns = getMonotonicTimeNs();
+
+	for (long i = 0; i < BENCHMARK_LOOPBACK_ITERATIONS; i++) {
+		const Pose tx_pose = {(double)i, 2.0, 3.0};
+		virtualLink_sendDataBlocking(sender, &tx_pose, sizeof(tx_pose));
+
+		Pose rx_pose;
+		const size_t rx_size = virtualLink_receiveDataBlockingNs(receiver,
+									 &rx_pose, sizeof(rx_pose),
+									 VIRTUAL_LINK_WAIT_FOREVER,
+									 nullptr);
+		if (sizeof(rx_pose) == rx_size) {
+			checksum += rx_pose.x;
+		}
+	}
+
+	const int64_t elapsed_ns = getMonotonicTimeNs() - start_ns;
+	std::printf("raw checksum %.0f\n", checksum);
+	return elapsed_ns;
+}
+
+/* Send and receive Pose over loopback using typed channel */
+static int64_t benchmarkChannelLoopback(struct virtualLinkObject *const sender,
+					struct virtualLinkObject *const receiver) {
+	BenchmarkChannel tx_channel(*sender);
+	BenchmarkChannel rx_channel(*receiver);
+	BenchmarkChannel::Frame frame;
+	double checksum = 0.0;
+
+	const auto handler = [&checksum](const auto &message) {
+		if constexpr (std::is_same_v<std::decay_t<decltype(message)>, Pose>) {
+			checksum += message.x;
+		}
+	};
+
+	const int64_t start_ns = getMonotonicTimeNs();
+
+	for (long i = 0; i < BENCHMARK_LOOPBACK_ITERATIONS; i++) {
+		tx_channel.emplace<Pose>((double)i, 2.0, 3.0);
+		rx_channel.receive(frame, VIRTUAL_LINK_WAIT_FOREVER, handler);
+	}
+
+	const int64_t elapsed_ns = getMonotonicTimeNs() - start_ns;
+	std::printf("channel checksum %.0f\n", checksum);
+	return elapsed_ns;
+}
+
+/* Compare dispatch with raw size check and cast of already received frame */
+static void benchmarkDispatch(void) {
+	BenchmarkChannel::Frame frame = {};
+	const BenchmarkChannel::MessageId pose_id = BenchmarkChannel::id<Pose>();
+	std::memcpy(frame.data, &pose_id, sizeof(pose_id));
+	::new (static_cast<void *>(frame.data + BenchmarkChannel::payload_offset)) Pose{1.0, 2.0, 3.0};
+	const std::size_t frame_size = BenchmarkChannel::payload_offset + sizeof(Pose);
+
+	// Keep compiler from hoisting frame pointer and size out of the loops
+	const std::byte *volatile frame_data = frame.data;
+	volatile std::size_t rx_size = frame_size;
+	double checksum = 0.0;
+
+	int64_t start_ns = getMonotonicTimeNs();
+	for (long i = 0; i < BENCHMARK_DISPATCH_ITERATIONS; i++) {
+		const std::byte *const rx_data = frame_data;
+		if ((frame_size == rx_size) && (pose_id == *reinterpret_cast<const uint16_t *>(rx_data))) {
+			const Pose &pose = *reinterpret_cast<const Pose *>(rx_data + BenchmarkChannel::payload_offset);
+			checksum += pose.x;
+		}
+	}
+	printResult("raw cast", getMonotonicTimeNs() - start_ns, BENCHMARK_DISPATCH_ITERATIONS);
+
+	const auto handler = [&checksum](const auto &message) {
+		if constexpr (std::is_same_v<std::decay_t<decltype(message)>, Pose>) {
+			checksum += message.x;
+		}
+	};
+
+	start_ns = getMonotonicTimeNs();
+	for (long i = 0; i < BENCHMARK_DISPATCH_ITERATIONS; i++) {
+		BenchmarkChannel::dispatch(frame_data, rx_size, handler);
+	}
+	printResult("channel dispatch", getMonotonicTimeNs() - start_ns, BENCHMARK_DISPATCH_ITERATIONS);
+
+	std::printf("dispatch checksum %.0f\n", checksum);
+}
+
+int main(void) {
+	struct virtualLinkConfig virtual_link_config;
+
+	if (!virtualLink_configFromStrings(&virtual_link_config,
+					   VIRTUAL_LINK_INTERFACE_IPV4,
+					   VIRTUAL_LINK_BENCHMARK_TX_IPV4,
+					   VIRTUAL_LINK_BENCHMARK_RX_IPV4)) {
+		return 1;
+	}
+
+	struct virtualLinkObject sender;
+	virtualLink_init(&sender, &virtual_link_config);
+
+	struct virtualLinkObject receiver;
+	virtual_link_config.tx_socket_address.port += 1;
+	virtualLink_init(&receiver, &virtual_link_config);
+
+	// Warm up both paths before measuring
+	benchmarkRawLoopback(&sender, &receiver);
+	benchmarkChannelLoopback(&sender, &receiver);
+
+	printResult("raw loopback", benchmarkRawLoopback(&sender, &receiver),
+		    BENCHMARK_LOOPBACK_ITERATIONS);
+	printResult("channel loopback", benchmarkChannelLoopback(&sender, &receiver),
+		    BENCHMARK_LOOPBACK_ITERATIONS);
+
+	benchmarkDispatch();
+
+	return 0;
+}
@@ -0,0 +1,125 @@
+#include <cstring>
+
+#include "unity.h"
+
+#include "virtualLinkChannel.hpp"
+
+#define VIRTUAL_LINK_INTERFACE_IPV4	"127.0.0.1"
+#define VIRTUAL_LINK_CHANNEL_TX_IPV4	"127.0.0.1:9070"
+#define VIRTUAL_LINK_CHANNEL_RX_IPV4	"224.0.0.123:9070"
+
+#define VIRTUAL_LINK_RECEIVE_TIMEOUT_NS (1000000000LL)
+
+struct Ping {
+	uint32_t sequence;
+};
+
+struct Pose {
+	double x;
+	double y;
+	double z;
+};
+
+using TestChannel = virtualLink::Channel<Ping, Pose>;
+
+static_assert(0 == TestChannel::id<Ping>());
+static_assert(1 == TestChannel::id<Pose>());
+static_assert(alignof(Pose) == TestChannel::payload_offset);
+static_assert(TestChannel::payload_offset + sizeof(Pose) == TestChannel::max_frame_size);
+
+struct ReceivedMessages {
+	int ping_count = 0;
+	int pose_count = 0;
+	Ping ping = {};
+	Pose pose = {};
+
+	void operator()(const Ping &message) {
+		ping_count++;
+		ping = message;
+	}
+
+	void operator()(const Pose &message) {
+		pose_count++;
+		pose = message;
+	}
+};
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+/* ------------------------------------------- TESTS ------------------------------------------- */
+void test_emplaceAndReceive(void) {
+	struct virtualLinkConfig virtual_link_config;
+
+	TEST_ASSERT(virtualLink_configFromStrings(&virtual_link_config,
+						  VIRTUAL_LINK_INTERFACE_IPV4,
+						  VIRTUAL_LINK_CHANNEL_TX_IPV4,
+						  VIRTUAL_LINK_CHANNEL_RX_IPV4));
+
+	struct virtualLinkObject virtual_link1;
+	virtualLink_init(&virtual_link1, &virtual_link_config);
+
+	struct virtualLinkObject virtual_link2;
+	virtual_link_config.tx_socket_address.port += 1;
+	virtualLink_init(&virtual_link2, &virtual_link_config);
+
+	TestChannel sender(virtual_link1);
+	TestChannel receiver(virtual_link2);
+
+	TEST_ASSERT(TestChannel::payload_offset + sizeof(Pose)
+		    == sender.emplace<Pose>(1.0, 2.0, 3.0));
+	TEST_ASSERT(TestChannel::payload_offset + sizeof(Ping)
+		    == sender.send(Ping{42}));
+
+	TestChannel::Frame frame;
+	ReceivedMessages received;
+
+	TEST_ASSERT(receiver.receive(frame, VIRTUAL_LINK_RECEIVE_TIMEOUT_NS, received));
+	TEST_ASSERT(1 == received.pose_count);
+	TEST_ASSERT(0 == received.ping_count);
+	TEST_ASSERT(1.0 == received.pose.x);
+	TEST_ASSERT(2.0 == received.pose.y);
+	TEST_ASSERT(3.0 == received.pose.z);
+
+	TEST_ASSERT(receiver.receive(frame, VIRTUAL_LINK_RECEIVE_TIMEOUT_NS, received));
+	TEST_ASSERT(1 == received.ping_count);
+	TEST_ASSERT(42 == received.ping.sequence);
+}
+
+void test_dispatchRejectsInvalidFrames(void) {
+	TestChannel::Frame frame = {};
+	ReceivedMessages received;
+
+	// Unknown message ID
+	const TestChannel::MessageId invalid_id = 2;
+	std::memcpy(frame.data, &invalid_id, sizeof(invalid_id));
+	TEST_ASSERT(!TestChannel::dispatch(frame.data, sizeof(frame.data), received));
+
+	// Payload size not matching message type
+	const TestChannel::MessageId ping_id = TestChannel::id<Ping>();
+	std::memcpy(frame.data, &ping_id, sizeof(ping_id));
+	TEST_ASSERT(!TestChannel::dispatch(frame.data,
+					   TestChannel::payload_offset + sizeof(Ping) + 1,
+					   received));
+
+	// Frame shorter than message ID
+	TEST_ASSERT(!TestChannel::dispatch(frame.data, sizeof(TestChannel::MessageId) - 1,
+					   received));
+
+	TEST_ASSERT(0 == received.ping_count);
+	TEST_ASSERT(0 == received.pose_count);
+
+	// Valid frame is still accepted
+	TEST_ASSERT(TestChannel::dispatch(frame.data,
+					  TestChannel::payload_offset + sizeof(Ping),
+					  received));
+	TEST_ASSERT(1 == received.ping_count);
+}
+
+int main(void) {
+	UNITY_BEGIN();
+	RUN_TEST(test_emplaceAndReceive);
+	RUN_TEST(test_dispatchRejectsInvalidFrames);
+	return UNITY_END();
+}
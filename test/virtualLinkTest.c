@@ -1,5 +1,8 @@
+#include <poll.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
+#include <unistd.h>
 
 #include "dumbFuzzer.h"
 #include "unity.h"
@@ -12,6 +15,30 @@
 #define VIRTUAL_LINK_TX_IPV4_BASE	"127.0.0.1:9000"
 #define VIRTUAL_LINK_RX_IPV4		"224.0.0.116:9000"
 
+#define VIRTUAL_LINK_CONTROL_TX_IPV4	"127.0.0.1:9010"
+#define VIRTUAL_LINK_CONTROL_RX_IPV4	"224.0.0.117:9010"
+#define VIRTUAL_LINK_BULK_TX_IPV4	"127.0.0.1:9020"
+#define VIRTUAL_LINK_BULK_RX_IPV4	"224.0.0.118:9020"
+#define VIRTUAL_LINK_INTEGRITY_TX_IPV4	"127.0.0.1:9030"
+#define VIRTUAL_LINK_INTEGRITY_RX_IPV4	"224.0.0.119:9030"
+
+#define VIRTUAL_LINK_DRAIN_TX_IPV4	"127.0.0.1:9050"
+#define VIRTUAL_LINK_DRAIN_RX_IPV4	"224.0.0.121:9050"
+
+#define VIRTUAL_LINK_TIMEOUT_TX_IPV4	"127.0.0.1:9060"
+#define VIRTUAL_LINK_TIMEOUT_RX_IPV4	"224.0.0.122:9060"
+
+#define VIRTUAL_LINK_BULK_CONFIG_FILE_CONTENT \
+	"# interface tx rx [options]\n" \
+	"127.0.0.1 127.0.0.1:9040 224.0.0.120:9040\n" \
+	"\n" \
+	"127.0.0.1 127.0.0.1:9041 224.0.0.120:9040 dscp=46 integrity\n" \
+	"127.0.0.1 127.0.0.1 224.0.0.120:9040\n" \
+	"127.0.0.1 127.0.0.1:9042 224.0.0.120:9040 color=blue\n" \
+	"127.0.0.1 127.0.0.1:1234567 224.0.0.120:9040\n" \
+	"127.0.0.1 127.0.0.1:65536 224.0.0.120:9040\n" \
+	"127.0.0.1 127.0.0.1:9040 224.0.0.120:9040\n"
+
 void setUp(void) {
 	time_t t;
 	srand((unsigned) time(&t));
@@ -70,6 +97,46 @@ static void sendAndReceive_2receivers(struct virtualLinkObject *const object1,
 
 	TEST_ASSERT_EQUAL_UINT8_ARRAY(data, read_data2, data_size);
 }
+
+struct rxOrder {
+	uint8_t markers[16];
+	size_t count;
+};
+
+static void recordRxOrder(const void *const rx_data, size_t rx_data_size,
+			  const struct virtualLinkSocketAddress *const originator_address,
+			  void *user_data) {
+	struct rxOrder *const rx_order = user_data;
+
+	TEST_ASSERT(rx_order->count < sizeof(rx_order->markers));
+	rx_order->markers[rx_order->count++] = *(const uint8_t *)rx_data;
+}
+
+static void initLanePair(struct virtualLinkObject *const sender,
+			 struct virtualLinkObject *const receiver,
+			 const char *const tx_address_string,
+			 const char *const rx_address_string,
+			 void *const rx_buffer, size_t rx_buffer_size) {
+	struct virtualLinkConfig virtual_link_config;
+
+	TEST_ASSERT(virtualLink_configFromStrings(&virtual_link_config,
+						  VIRTUAL_LINK_INTERFACE_IPV4,
+						  tx_address_string,
+						  rx_address_string));
+	virtual_link_config.rx_buffer = rx_buffer;
+	virtual_link_config.rx_buffer_size = rx_buffer_size;
+
+	virtualLink_init(sender, &virtual_link_config);
+
+	virtual_link_config.tx_socket_address.port += 1;
+	virtualLink_init(receiver, &virtual_link_config);
+}
+
+static int64_t getMonotonicTimeNs(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((int64_t)now.tv_sec * 1000000000LL) + (int64_t)now.tv_nsec;
+}
 /* ------------------------------------------- TESTS ------------------------------------------- */
 
 #define TEST_SEND_AND_RECEIVE_ITERATIONS (1000)
@@ -129,9 +196,240 @@ void test_sendAndReceive_2receivers(void) {
 	}
 }
 
+void test_prioritizedProcessing(void) {
+	uint8_t control_rx_buffer[VIRTUAL_LINK_MTU];
+	uint8_t bulk_rx_buffer[VIRTUAL_LINK_MTU];
+
+	struct virtualLinkObject control_sender, control_receiver;
+	initLanePair(&control_sender, &control_receiver,
+		     VIRTUAL_LINK_CONTROL_TX_IPV4, VIRTUAL_LINK_CONTROL_RX_IPV4,
+		     control_rx_buffer, sizeof(control_rx_buffer));
+
+	struct virtualLinkObject bulk_sender, bulk_receiver;
+	initLanePair(&bulk_sender, &bulk_receiver,
+		     VIRTUAL_LINK_BULK_TX_IPV4, VIRTUAL_LINK_BULK_RX_IPV4,
+		     bulk_rx_buffer, sizeof(bulk_rx_buffer));
+
+	struct rxOrder rx_order = {0};
+	virtualLink_registerRxDoneCallback(&control_receiver, recordRxOrder, &rx_order);
+	virtualLink_enableRxInterrupt(&control_receiver, true);
+	virtualLink_registerRxDoneCallback(&bulk_receiver, recordRxOrder, &rx_order);
+	virtualLink_enableRxInterrupt(&bulk_receiver, true);
+
+	// Bulk traffic is sent before control message
+	const uint8_t bulk_marker = 'B';
+	const uint8_t control_marker = 'C';
+	for (int i = 0; i < 3; i++) {
+		virtualLink_sendDataBlocking(&bulk_sender, &bulk_marker, sizeof(bulk_marker));
+	}
+	virtualLink_sendDataBlocking(&control_sender, &control_marker, sizeof(control_marker));
+
+	const struct virtualLinkObject *const lane_objects[] = {
+		&control_receiver,
+		&bulk_receiver,
+	};
+	const struct virtualLinkLanes lanes = {
+		.objects = lane_objects,
+		.objects_count = 2,
+		.budget_per_lane = 2,
+	};
+
+	// Control message goes first, bulk traffic is limited by budget
+	virtualLink_Meta_prioritizedProcessingLoop(&lanes);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY("CBB", rx_order.markers, 3);
+	TEST_ASSERT(3 == rx_order.count);
+
+	virtualLink_Meta_prioritizedProcessingLoop(&lanes);
+	TEST_ASSERT(4 == rx_order.count);
+	TEST_ASSERT(bulk_marker == rx_order.markers[3]);
+
+	// Lane with RX interrupt disabled is still emptied, without calling callback
+	virtualLink_enableRxInterrupt(&bulk_receiver, false);
+	virtualLink_sendDataBlocking(&bulk_sender, &bulk_marker, sizeof(bulk_marker));
+
+	struct pollfd poll_fd = {
+		.fd = virtualLink_getPollFd(&bulk_receiver),
+		.events = POLLIN,
+	};
+	TEST_ASSERT(1 == poll(&poll_fd, 1, 1000));
+
+	virtualLink_Meta_prioritizedProcessingLoop(&lanes);
+	TEST_ASSERT(4 == rx_order.count);
+	TEST_ASSERT(0 == poll(&poll_fd, 1, 0));
+}
+
+void test_integrityTrailer(void) {
+	struct virtualLinkConfig virtual_link_config;
+
+	virtualLink_configFromStrings(&virtual_link_config,
+				      VIRTUAL_LINK_INTERFACE_IPV4,
+				      VIRTUAL_LINK_INTEGRITY_TX_IPV4,
+				      VIRTUAL_LINK_INTEGRITY_RX_IPV4);
+
+	// Sender without trailer, used to inject packets with invalid trailer
+	struct virtualLinkObject raw_sender;
+	virtualLink_init(&raw_sender, &virtual_link_config);
+
+	virtual_link_config.is_integrity_trailer_enabled = true;
+
+	struct virtualLinkObject sender;
+	virtual_link_config.tx_socket_address.port += 1;
+	virtualLink_init(&sender, &virtual_link_config);
+
+	struct virtualLinkObject receiver;
+	virtual_link_config.tx_socket_address.port += 1;
+	virtualLink_init(&receiver, &virtual_link_config);
+
+	// Payload filling whole rx buffer is still verified correctly
+	for(int i = 0; i < TEST_SEND_AND_RECEIVE_ITERATIONS; i++) {
+		uint8_t sample_data[VIRTUAL_LINK_MTU];
+		const uint8_t data_size =
+			dumbFuzzer_generateRandomU32InRange(1, sizeof(sample_data));
+		dumbFuzzer_genereteRandomData(&sample_data, data_size);
+
+		sendAndReceive(&sender, &receiver, sample_data, data_size);
+	}
+	TEST_ASSERT(0 == virtualLink_getIntegrityFailuresCount(&receiver));
+
+	// Corrupted packet is dropped and counted
+	const uint8_t corrupted_data[] = {0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x00, 0x00, 0x00};
+	virtualLink_sendDataBlocking(&raw_sender, corrupted_data, sizeof(corrupted_data));
+
+	uint8_t read_data[VIRTUAL_LINK_MTU];
+	const size_t read_result = virtualLink_receiveDataBlocking(&receiver,
+								   read_data, sizeof(read_data),
+								   VIRTUAL_LINK_WAIT_FOREVER,
+								   NULL);
+	TEST_ASSERT(0 == read_result);
+	TEST_ASSERT(1 == virtualLink_getIntegrityFailuresCount(&receiver));
+}
+
+void test_bulkProvisioning(void) {
+	char path[] = "/tmp/virtualLinkTestXXXXXX";
+	const int fd = mkstemp(path);
+	TEST_ASSERT(-1 != fd);
+	const char content[] = VIRTUAL_LINK_BULK_CONFIG_FILE_CONTENT;
+	TEST_ASSERT(sizeof(content) - 1 == write(fd, content, sizeof(content) - 1));
+	close(fd);
+
+	struct virtualLinkConfig configs[7];
+	enum virtualLinkStatus validation_statuses[7];
+	size_t configs_count;
+
+	const bool ret = virtualLink_loadConfigsFromFile(path, configs, validation_statuses, 7,
+							 &configs_count);
+	unlink(path);
+	TEST_ASSERT(ret);
+	TEST_ASSERT(7 == configs_count);
+
+	// Invalid lines are rejected up front
+	TEST_ASSERT(VIRTUAL_LINK_STATUS_OK == validation_statuses[0]);
+	TEST_ASSERT(VIRTUAL_LINK_STATUS_OK == validation_statuses[1]);
+	TEST_ASSERT(VIRTUAL_LINK_STATUS_INVALID_CONFIG == validation_statuses[2]);
+	TEST_ASSERT(VIRTUAL_LINK_STATUS_INVALID_CONFIG == validation_statuses[3]);
+	TEST_ASSERT(VIRTUAL_LINK_STATUS_INVALID_CONFIG == validation_statuses[4]);
+	TEST_ASSERT(VIRTUAL_LINK_STATUS_INVALID_CONFIG == validation_statuses[5]);
+	// Duplicated TX address of link 0
+	TEST_ASSERT(VIRTUAL_LINK_STATUS_INVALID_CONFIG == validation_statuses[6]);
+	TEST_ASSERT(46 == configs[1].dscp);
+	TEST_ASSERT(configs[1].is_integrity_trailer_enabled);
+
+	struct virtualLinkObject objects[7];
+	enum virtualLinkStatus statuses[7];
+	virtualLink_initMany(objects, configs, validation_statuses, statuses, 7, 4);
+
+	TEST_ASSERT(VIRTUAL_LINK_STATUS_OK == statuses[0]);
+	TEST_ASSERT(VIRTUAL_LINK_STATUS_OK == statuses[1]);
+	for (int i = 2; i <= 6; i++) {
+		TEST_ASSERT(VIRTUAL_LINK_STATUS_INVALID_CONFIG == statuses[i]);
+	}
+}
+
+static bool isPollFdReadable(const struct virtualLinkObject *const object, int timeout_ms) {
+	struct pollfd poll_fd = {
+		.fd = virtualLink_getPollFd(object),
+		.events = POLLIN,
+	};
+
+	return 1 == poll(&poll_fd, 1, timeout_ms);
+}
+
+void test_receiveTimeoutNs(void) {
+	struct virtualLinkConfig virtual_link_config;
+
+	virtualLink_configFromStrings(&virtual_link_config,
+				      VIRTUAL_LINK_INTERFACE_IPV4,
+				      VIRTUAL_LINK_TIMEOUT_TX_IPV4,
+				      VIRTUAL_LINK_TIMEOUT_RX_IPV4);
+
+	struct virtualLinkObject virtual_link;
+	virtualLink_init(&virtual_link, &virtual_link_config);
+
+	// Sub-millisecond timeout with no traffic
+	const int64_t timeout_ns = 200000;
+	uint8_t read_data[VIRTUAL_LINK_MTU];
+
+	const int64_t start_ns = getMonotonicTimeNs();
+	const size_t read_result = virtualLink_receiveDataBlockingNs(&virtual_link,
+								     read_data, sizeof(read_data),
+								     timeout_ns,
+								     NULL);
+	const int64_t elapsed_ns = getMonotonicTimeNs() - start_ns;
+
+	TEST_ASSERT(0 == read_result);
+	TEST_ASSERT(elapsed_ns >= timeout_ns);
+	TEST_ASSERT(elapsed_ns < 50000000);
+}
+
+void test_drain(void) {
+	uint8_t rx_buffer[VIRTUAL_LINK_MTU];
+
+	struct virtualLinkObject sender, receiver;
+	initLanePair(&sender, &receiver,
+		     VIRTUAL_LINK_DRAIN_TX_IPV4, VIRTUAL_LINK_DRAIN_RX_IPV4,
+		     rx_buffer, sizeof(rx_buffer));
+
+	struct rxOrder rx_order = {0};
+	virtualLink_registerRxDoneCallback(&receiver, recordRxOrder, &rx_order);
+	virtualLink_enableRxInterrupt(&receiver, true);
+
+	TEST_ASSERT(!isPollFdReadable(&receiver, 0));
+
+	for (uint8_t marker = 0; marker < 3; marker++) {
+		virtualLink_sendDataBlocking(&sender, &marker, sizeof(marker));
+	}
+
+	TEST_ASSERT(isPollFdReadable(&receiver, 1000));
+
+	// Budget limits amount of processed packets
+	TEST_ASSERT(2 == virtualLink_drain(&receiver, 2));
+	TEST_ASSERT(isPollFdReadable(&receiver, 0));
+	TEST_ASSERT(1 == virtualLink_drain(&receiver, 10));
+	TEST_ASSERT(0 == virtualLink_drain(&receiver, 10));
+
+	TEST_ASSERT(!isPollFdReadable(&receiver, 0));
+	TEST_ASSERT(3 == rx_order.count);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY("\x00\x01\x02", rx_order.markers, 3);
+
+	// With RX interrupt disabled packets are dropped, not left in socket
+	virtualLink_enableRxInterrupt(&receiver, false);
+	const uint8_t marker = 3;
+	virtualLink_sendDataBlocking(&sender, &marker, sizeof(marker));
+	TEST_ASSERT(isPollFdReadable(&receiver, 1000));
+
+	TEST_ASSERT(1 == virtualLink_drain(&receiver, 10));
+	TEST_ASSERT(!isPollFdReadable(&receiver, 0));
+	TEST_ASSERT(3 == rx_order.count);
+}
+
 int main(void) {
 	UNITY_BEGIN();
 	RUN_TEST(test_sendAndReceive);
 	//RUN_TEST(test_sendAndReceive_2receivers);
+	RUN_TEST(test_prioritizedProcessing);
+	RUN_TEST(test_integrityTrailer);
+	RUN_TEST(test_bulkProvisioning);
+	RUN_TEST(test_drain);
+	RUN_TEST(test_receiveTimeoutNs);
 	return UNITY_END();
 }